@@ -0,0 +1,457 @@
+#include "Runtime/ECS/TransformHierarchy.h"
+
+#include <algorithm>
+
+namespace Alice
+{
+	namespace
+	{
+		inline DirectX::XMMATRIX BuildLocalMatrix(const TransformComponent& transform)
+		{
+			DirectX::XMMATRIX S = DirectX::XMMatrixScaling(transform.scale.x, transform.scale.y, transform.scale.z);
+			DirectX::XMMATRIX R = DirectX::XMMatrixRotationRollPitchYaw(transform.rotation.x, transform.rotation.y, transform.rotation.z);
+			DirectX::XMMATRIX T = DirectX::XMMatrixTranslation(transform.position.x, transform.position.y, transform.position.z);
+			return S * R * T;
+		}
+
+		// order[newSlot] = oldSlot 순서로 배열 재배치
+		template <typename T>
+		void ApplyOrder(std::vector<T>& values, const std::vector<std::uint32_t>& order)
+		{
+			std::vector<T> sorted;
+			sorted.reserve(values.size());
+			for (std::uint32_t oldSlot : order)
+				sorted.push_back(values[oldSlot]);
+			values.swap(sorted);
+		}
+	}
+
+	void TransformHierarchy::Clear()
+	{
+		// Sparse는 fill로 초기화 (메모리 재할당 방지)
+		std::fill(m_slotOf.begin(), m_slotOf.end(), NullSlot);
+		m_entities.clear();
+		m_parentIds.clear();
+		m_parentSlots.clear();
+		m_dirty.clear();
+		m_world.clear();
+		std::fill(m_links.begin(), m_links.end(), ChildLinks{});
+		m_rootLinks = ChildLinks{};
+		m_pendingReparent.clear();
+		m_orderDirty = false;
+	}
+
+	void TransformHierarchy::Insert(EntityId id, EntityId parent)
+	{
+		if (id == InvalidEntityId)
+			return;
+
+		if (SlotOf(id) != NullSlot)
+		{
+			SetParent(id, parent);
+			return;
+		}
+
+		if (id >= m_slotOf.size())
+			m_slotOf.resize(id + 1, NullSlot);
+
+		// 새 슬롯은 항상 맨 뒤 -> 이미 등록된 부모보다 뒤이므로 순서 유지
+		const std::uint32_t slot = static_cast<std::uint32_t>(m_entities.size());
+		m_slotOf[id] = slot;
+		m_entities.push_back(id);
+		m_parentIds.push_back(InvalidEntityId);
+		m_parentSlots.push_back(NullSlot);
+		m_dirty.push_back(1);
+
+		DirectX::XMFLOAT4X4A identity;
+		DirectX::XMStoreFloat4x4A(&identity, DirectX::XMMatrixIdentity());
+		m_world.push_back(identity);
+
+		LinkParent(slot, parent);
+		AppendChild(parent, id);
+
+		// 이 엔티티를 부모로 가리키던(먼저 등록된) 자식들의 슬롯 연결
+		ResolvePendingChildren(id, slot);
+	}
+
+	void TransformHierarchy::Remove(EntityId id)
+	{
+		const std::uint32_t slot = SlotOf(id);
+		if (slot == NullSlot)
+			return;
+
+		// 남은 자식은 월드행렬상 루트로 취급
+		// (자식 목록과 parentId는 유지 -> 부모가 다시 등록되면 재연결)
+		std::vector<EntityId> orphans;
+		for (EntityId child = LinksOf(id).firstChild; child != InvalidEntityId; child = m_links[child].nextSibling)
+		{
+			const std::uint32_t childSlot = SlotOf(child);
+			if (childSlot != NullSlot && m_parentSlots[childSlot] == slot)
+			{
+				m_parentSlots[childSlot] = NullSlot;
+				orphans.push_back(child);
+			}
+		}
+
+		DetachChild(m_parentIds[slot], id);
+		UnlinkParent(slot);
+		m_slotOf[id] = NullSlot;
+
+		// Swap-and-pop: 마지막 슬롯을 빈 자리로 이동
+		const std::uint32_t last = static_cast<std::uint32_t>(m_entities.size() - 1);
+		if (slot != last)
+		{
+			const EntityId moved = m_entities[last];
+			m_entities[slot] = moved;
+			m_parentIds[slot] = m_parentIds[last];
+			m_parentSlots[slot] = m_parentSlots[last];
+			m_dirty[slot] = m_dirty[last];
+			m_world[slot] = m_world[last];
+			m_slotOf[moved] = slot;
+
+			// 이동한 슬롯의 자식들이 가리키는 부모 슬롯 갱신
+			for (EntityId child = LinksOf(moved).firstChild; child != InvalidEntityId; child = m_links[child].nextSibling)
+			{
+				const std::uint32_t childSlot = SlotOf(child);
+				if (childSlot == NullSlot || m_parentSlots[childSlot] != last)
+					continue;
+
+				m_parentSlots[childSlot] = slot;
+				if (slot > childSlot)
+					m_orderDirty = true;
+			}
+
+			// 이동한 슬롯이 부모보다 앞에 오게 되면 순서 재구성 필요
+			const std::uint32_t parentSlot = m_parentSlots[slot];
+			if (parentSlot != NullSlot && parentSlot > slot)
+				m_orderDirty = true;
+		}
+
+		m_entities.pop_back();
+		m_parentIds.pop_back();
+		m_parentSlots.pop_back();
+		m_dirty.pop_back();
+		m_world.pop_back();
+
+		for (EntityId orphan : orphans)
+			MarkDirty(orphan);
+	}
+
+	void TransformHierarchy::SetParent(EntityId id, EntityId parent)
+	{
+		const std::uint32_t slot = SlotOf(id);
+		if (slot == NullSlot)
+			return;
+
+		if (m_parentIds[slot] != parent)
+		{
+			DetachChild(m_parentIds[slot], id);
+			UnlinkParent(slot);
+			LinkParent(slot, parent);
+			AppendChild(parent, id);
+		}
+		MarkDirty(id);
+	}
+
+	void TransformHierarchy::MarkDirty(EntityId id)
+	{
+		const std::uint32_t slot = SlotOf(id);
+		if (slot == NullSlot)
+			return;
+
+		MarkSubtreeDirty(slot);
+	}
+
+	EntityId TransformHierarchy::GetParent(EntityId id) const
+	{
+		const std::uint32_t slot = SlotOf(id);
+		if (slot == NullSlot)
+			return InvalidEntityId;
+		return m_parentIds[slot];
+	}
+
+	std::vector<EntityId> TransformHierarchy::GetChildren(EntityId parent) const
+	{
+		std::vector<EntityId> children;
+
+		const ChildLinks* links = nullptr;
+		if (parent == InvalidEntityId)
+			links = &m_rootLinks;
+		else if (parent < m_links.size())
+			links = &m_links[parent];
+
+		if (!links)
+			return children;
+
+		for (EntityId child = links->firstChild; child != InvalidEntityId; child = m_links[child].nextSibling)
+			children.push_back(child);
+		return children;
+	}
+
+	DirectX::XMMATRIX TransformHierarchy::Resolve(EntityId id, const ComponentStorage<TransformComponent>& transforms)
+	{
+		const std::uint32_t slot = SlotOf(id);
+		if (slot == NullSlot)
+		{
+			const TransformComponent* t = transforms.Get(id);
+			return t ? BuildLocalMatrix(*t) : DirectX::XMMatrixIdentity();
+		}
+
+		if (m_orderDirty)
+			Rebuild();
+
+		return ResolveSlot(SlotOf(id), transforms);
+	}
+
+	void TransformHierarchy::Update(const ComponentStorage<TransformComponent>& transforms)
+	{
+		if (m_orderDirty)
+			Rebuild();
+
+		UpdatePass(transforms);
+
+		// TransformComponent::parent를 직접 바꾼 엔티티는 계층을 맞춘 뒤 한 번 더 갱신
+		if (!m_pendingReparent.empty())
+		{
+			std::vector<EntityId> pending;
+			pending.swap(m_pendingReparent);
+			for (EntityId id : pending)
+			{
+				if (const TransformComponent* t = transforms.Get(id))
+					SetParent(id, t->parent);
+			}
+
+			if (m_orderDirty)
+				Rebuild();
+
+			UpdatePass(transforms);
+			m_pendingReparent.clear();
+		}
+	}
+
+	DirectX::XMMATRIX TransformHierarchy::ResolveSlot(std::uint32_t slot, const ComponentStorage<TransformComponent>& transforms)
+	{
+		if (!m_dirty[slot])
+			return DirectX::XMLoadFloat4x4A(&m_world[slot]);
+
+		// 불변식상 dirty 조상은 연속된 체인이므로 필요한 슬롯만 재귀적으로 계산됨
+		const TransformComponent* t = transforms.Get(m_entities[slot]);
+		DirectX::XMMATRIX world = t ? BuildLocalMatrix(*t) : DirectX::XMMatrixIdentity();
+
+		const std::uint32_t parentSlot = m_parentSlots[slot];
+		if (parentSlot != NullSlot)
+			world = world * ResolveSlot(parentSlot, transforms);
+
+		DirectX::XMStoreFloat4x4A(&m_world[slot], world);
+		m_dirty[slot] = 0;
+		return world;
+	}
+
+	void TransformHierarchy::UpdatePass(const ComponentStorage<TransformComponent>& transforms)
+	{
+		// 부모가 항상 앞에 있으므로 부모 월드행렬은 이미 최신 상태
+		const std::size_t count = m_entities.size();
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (!m_dirty[i])
+				continue;
+
+			const EntityId id = m_entities[i];
+			const TransformComponent* t = transforms.Get(id);
+			DirectX::XMMATRIX world = t ? BuildLocalMatrix(*t) : DirectX::XMMatrixIdentity();
+
+			if (t && t->parent != m_parentIds[i])
+				m_pendingReparent.push_back(id);
+
+			const std::uint32_t parentSlot = m_parentSlots[i];
+			if (parentSlot != NullSlot)
+				world = world * DirectX::XMLoadFloat4x4A(&m_world[parentSlot]);
+
+			DirectX::XMStoreFloat4x4A(&m_world[i], world);
+			m_dirty[i] = 0;
+		}
+	}
+
+	void TransformHierarchy::LinkParent(std::uint32_t slot, EntityId parent)
+	{
+		m_parentIds[slot] = parent;
+		m_parentSlots[slot] = NullSlot;
+
+		// 부모 Transform이 아직 없으면 등록될 때 ResolvePendingChildren에서 연결
+		const std::uint32_t parentSlot = (parent != InvalidEntityId) ? SlotOf(parent) : NullSlot;
+		if (parentSlot == NullSlot)
+			return;
+
+		// 순환 방지: 부모 체인에 자신이 있으면 루트로 취급
+		if (IsAncestorSlot(slot, parentSlot))
+			return;
+
+		m_parentSlots[slot] = parentSlot;
+		if (parentSlot > slot)
+			m_orderDirty = true;
+	}
+
+	void TransformHierarchy::UnlinkParent(std::uint32_t slot)
+	{
+		m_parentIds[slot] = InvalidEntityId;
+		m_parentSlots[slot] = NullSlot;
+	}
+
+	void TransformHierarchy::AppendChild(EntityId parent, EntityId child)
+	{
+		// 두 링크 모두 크기 확보 후 참조 (resize로 인한 참조 무효화 방지)
+		LinksOf(std::max(parent, child));
+		ChildLinks& childLinks = m_links[child];
+		ChildLinks& parentLinks = (parent == InvalidEntityId) ? m_rootLinks : m_links[parent];
+
+		childLinks.prevSibling = parentLinks.lastChild;
+		childLinks.nextSibling = InvalidEntityId;
+		if (parentLinks.lastChild != InvalidEntityId)
+			m_links[parentLinks.lastChild].nextSibling = child;
+		else
+			parentLinks.firstChild = child;
+		parentLinks.lastChild = child;
+	}
+
+	void TransformHierarchy::DetachChild(EntityId parent, EntityId child)
+	{
+		LinksOf(std::max(parent, child));
+		ChildLinks& childLinks = m_links[child];
+		ChildLinks& parentLinks = (parent == InvalidEntityId) ? m_rootLinks : m_links[parent];
+
+		if (childLinks.prevSibling != InvalidEntityId)
+			m_links[childLinks.prevSibling].nextSibling = childLinks.nextSibling;
+		else
+			parentLinks.firstChild = childLinks.nextSibling;
+
+		if (childLinks.nextSibling != InvalidEntityId)
+			m_links[childLinks.nextSibling].prevSibling = childLinks.prevSibling;
+		else
+			parentLinks.lastChild = childLinks.prevSibling;
+
+		childLinks.prevSibling = InvalidEntityId;
+		childLinks.nextSibling = InvalidEntityId;
+	}
+
+	bool TransformHierarchy::IsAncestorSlot(std::uint32_t ancestor, std::uint32_t slot) const
+	{
+		for (std::uint32_t cur = slot; cur != NullSlot; cur = m_parentSlots[cur])
+		{
+			if (cur == ancestor)
+				return true;
+		}
+		return false;
+	}
+
+	void TransformHierarchy::ResolvePendingChildren(EntityId parent, std::uint32_t parentSlot)
+	{
+		// 자식 목록은 부모 Transform 유무와 무관하게 유지되므로 이 부모의 자식만 확인하면 됨
+		std::vector<EntityId> linked;
+		for (EntityId child = LinksOf(parent).firstChild; child != InvalidEntityId; child = m_links[child].nextSibling)
+		{
+			const std::uint32_t childSlot = SlotOf(child);
+			if (childSlot == NullSlot || m_parentSlots[childSlot] != NullSlot)
+				continue;
+			if (IsAncestorSlot(childSlot, parentSlot))
+				continue;
+
+			m_parentSlots[childSlot] = parentSlot;
+			if (parentSlot > childSlot)
+				m_orderDirty = true;
+			linked.push_back(child);
+		}
+
+		for (EntityId child : linked)
+			MarkDirty(child);
+	}
+
+	void TransformHierarchy::MarkSubtreeDirty(std::uint32_t slot)
+	{
+		// 불변식: 이미 dirty면 자손도 모두 dirty
+		if (m_dirty[slot])
+			return;
+		m_dirty[slot] = 1;
+
+		// 자식 인덱스를 따라 서브트리만 방문 (슬롯 순서와 무관)
+		std::vector<EntityId> stack;
+		stack.push_back(m_entities[slot]);
+		while (!stack.empty())
+		{
+			const EntityId id = stack.back();
+			stack.pop_back();
+
+			if (id >= m_links.size())
+				continue;
+
+			for (EntityId child = m_links[id].firstChild; child != InvalidEntityId; child = m_links[child].nextSibling)
+			{
+				const std::uint32_t childSlot = SlotOf(child);
+				if (childSlot == NullSlot || m_dirty[childSlot])
+					continue;
+
+				m_dirty[childSlot] = 1;
+				stack.push_back(child);
+			}
+		}
+	}
+
+	void TransformHierarchy::Rebuild()
+	{
+		const std::size_t count = m_entities.size();
+
+		// 1. 슬롯별 깊이 계산 (조상 방향으로 올라가며 메모이제이션)
+		std::vector<std::uint32_t> depth(count, NullSlot);
+		std::vector<std::uint32_t> chain;
+		std::uint32_t maxDepth = 0;
+		for (std::uint32_t s = 0; s < count; ++s)
+		{
+			if (depth[s] != NullSlot)
+				continue;
+
+			chain.clear();
+			std::uint32_t cur = s;
+			while (cur != NullSlot && depth[cur] == NullSlot)
+			{
+				chain.push_back(cur);
+				cur = m_parentSlots[cur];
+			}
+
+			std::uint32_t d = (cur == NullSlot) ? 0u : depth[cur] + 1u;
+			for (std::size_t k = chain.size(); k-- > 0; ++d)
+				depth[chain[k]] = d;
+
+			maxDepth = std::max(maxDepth, d);
+		}
+
+		// 2. 깊이 기준 계수 정렬 (안정 정렬 -> 같은 깊이 내 기존 순서 유지)
+		std::vector<std::uint32_t> offsets(static_cast<std::size_t>(maxDepth) + 2, 0);
+		for (std::uint32_t s = 0; s < count; ++s)
+			++offsets[depth[s] + 1];
+		for (std::size_t d = 1; d < offsets.size(); ++d)
+			offsets[d] += offsets[d - 1];
+
+		std::vector<std::uint32_t> order(count);
+		for (std::uint32_t s = 0; s < count; ++s)
+			order[offsets[depth[s]]++] = s;
+
+		std::vector<std::uint32_t> remap(count);
+		for (std::uint32_t newSlot = 0; newSlot < count; ++newSlot)
+			remap[order[newSlot]] = newSlot;
+
+		// 3. 배열 재배치 + 부모 슬롯 재매핑
+		ApplyOrder(m_entities, order);
+		ApplyOrder(m_parentIds, order);
+		ApplyOrder(m_parentSlots, order);
+		ApplyOrder(m_dirty, order);
+		ApplyOrder(m_world, order);
+
+		for (std::uint32_t s = 0; s < count; ++s)
+		{
+			m_slotOf[m_entities[s]] = s;
+			if (m_parentSlots[s] != NullSlot)
+				m_parentSlots[s] = remap[m_parentSlots[s]];
+		}
+
+		m_orderDirty = false;
+	}
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <DirectXMath.h>
+
+#include "Runtime/ECS/Entity.h"
+#include "Runtime/ECS/Components/ComponentStorage.h"
+#include "Runtime/ECS/Components/TransformComponent.h"
+
+namespace Alice
+{
+    /// Transform 부모-자식 계층 전용 저장소 (ComponentStorage<TransformComponent> 옆에서 World가 관리)
+    /// - 엔티티를 "부모가 항상 자식보다 앞" 순서(위상 정렬)로 평탄한 배열에 보관합니다.
+    /// - 부모는 EntityId가 아닌 dense 슬롯 인덱스로 보관합니다.
+    /// - Update()는 배열을 앞에서부터 한 번만 훑으며, 이미 계산된 부모 월드행렬에
+    ///   로컬행렬을 곱해 dirty 슬롯의 월드행렬을 갱신합니다. (조상 재계산 없음)
+    /// - 월드행렬은 16바이트 정렬(XMFLOAT4X4A)로 저장해 SIMD 정렬 로드/스토어를 사용합니다.
+    /// - 부모 -> 첫 자식 / 다음 형제 인덱스를 항상 유지하므로 자식 조회와
+    ///   dirty 전파는 서브트리 크기에 비례합니다. (전체 Transform 스캔 없음)
+    ///
+    /// 불변식:
+    /// - dirty 슬롯의 모든 자손도 dirty 입니다. (MarkDirty가 서브트리 전체를 마킹)
+    /// - m_orderDirty == false 이면 모든 슬롯에서 parentSlot < slot 입니다.
+    class TransformHierarchy
+    {
+    public:
+        static constexpr std::uint32_t NullSlot = 0xFFFFFFFFu;
+
+        /// 모든 데이터 클리어
+        void Clear();
+
+        /// Transform이 추가된 엔티티를 등록합니다. (이미 있으면 부모만 동기화)
+        void Insert(EntityId id, EntityId parent);
+
+        /// Transform이 제거된 엔티티를 해제합니다. 남은 자식은 루트로 취급됩니다.
+        void Remove(EntityId id);
+
+        /// 부모를 변경합니다. (순환이 생기면 루트로 취급)
+        void SetParent(EntityId id, EntityId parent);
+
+        /// 엔티티와 모든 자손을 dirty로 표시합니다.
+        void MarkDirty(EntityId id);
+
+        bool Contains(EntityId id) const { return SlotOf(id) != NullSlot; }
+        EntityId GetParent(EntityId id) const;
+        std::size_t Size() const { return m_entities.size(); }
+
+        /// parent를 부모로 가진 엔티티들 (InvalidEntityId면 루트들). 부모 Transform 유무와 무관합니다.
+        std::vector<EntityId> GetChildren(EntityId parent) const;
+
+        /// 단일 엔티티의 월드행렬을 반환합니다.
+        /// dirty면 부모 체인을 따라 필요한 슬롯만 계산하고 캐시합니다.
+        DirectX::XMMATRIX Resolve(EntityId id, const ComponentStorage<TransformComponent>& transforms);
+
+        /// dirty 슬롯 전체의 월드행렬을 한 번의 선형 패스로 갱신합니다.
+        void Update(const ComponentStorage<TransformComponent>& transforms);
+
+    private:
+        std::uint32_t SlotOf(EntityId id) const
+        {
+            return (id < m_slotOf.size()) ? m_slotOf[id] : NullSlot;
+        }
+
+        // 부모 -> 자식 연결 리스트 (EntityId 기준이라 슬롯 재배치와 무관)
+        struct ChildLinks
+        {
+            EntityId firstChild = InvalidEntityId;
+            EntityId lastChild = InvalidEntityId;
+            EntityId prevSibling = InvalidEntityId;
+            EntityId nextSibling = InvalidEntityId;
+        };
+
+        ChildLinks& LinksOf(EntityId id)
+        {
+            if (id >= m_links.size())
+                m_links.resize(static_cast<std::size_t>(id) + 1);
+            return m_links[id];
+        }
+
+        DirectX::XMMATRIX ResolveSlot(std::uint32_t slot, const ComponentStorage<TransformComponent>& transforms);
+        void UpdatePass(const ComponentStorage<TransformComponent>& transforms);
+        void LinkParent(std::uint32_t slot, EntityId parent);
+        void UnlinkParent(std::uint32_t slot);
+        void AppendChild(EntityId parent, EntityId child);
+        void DetachChild(EntityId parent, EntityId child);
+        bool IsAncestorSlot(std::uint32_t ancestor, std::uint32_t slot) const;
+        void ResolvePendingChildren(EntityId parent, std::uint32_t parentSlot);
+        void MarkSubtreeDirty(std::uint32_t slot);
+        void Rebuild();
+
+    private:
+        // Sparse: EntityId -> 슬롯 (NullSlot이면 미등록)
+        std::vector<std::uint32_t> m_slotOf;
+
+        // Dense (슬롯 인덱스 기준, 위상 정렬 순서)
+        std::vector<EntityId> m_entities;                 // 슬롯의 엔티티
+        std::vector<EntityId> m_parentIds;                // TransformComponent::parent 원본 값
+        std::vector<std::uint32_t> m_parentSlots;         // 부모 슬롯 (없거나 미등록이면 NullSlot)
+        std::vector<std::uint8_t> m_dirty;                // 월드행렬 재계산 필요 여부
+        std::vector<DirectX::XMFLOAT4X4A> m_world;        // 캐시된 월드행렬
+
+        // Sparse: EntityId -> 자식/형제 링크
+        // 루트(부모 없음) 목록은 m_rootLinks의 firstChild/lastChild로 관리
+        std::vector<ChildLinks> m_links;
+        ChildLinks m_rootLinks;
+
+        // 부모-자식 순서가 깨졌는지 (다음 Resolve/Update 전에 Rebuild)
+        bool m_orderDirty = false;
+
+        // Update 중 TransformComponent::parent와 불일치가 발견된 엔티티 (직접 대입 대비)
+        std::vector<EntityId> m_pendingReparent;
+    };
+}
@@ -48,8 +48,7 @@ namespace Alice {
 		m_scripts.clear();
 		m_delayedDestructions.clear();
 		m_entityGenerations.clear();
-		m_transformDirty.clear();
-		m_worldMatrixCache.clear();
+		m_transformHierarchy.Clear();
 		InvalidateChildrenCache();
 		m_frameCombatHits = nullptr;
 		m_scriptCombatEnabled = false;
@@ -125,9 +124,8 @@ namespace Alice {
 
 		m_names.erase(id);
 
-		// Transform 캐시 제거
-		m_transformDirty.erase(id);
-		m_worldMatrixCache.erase(id);
+		// Transform 계층/캐시 제거
+		m_transformHierarchy.Remove(id);
 
 		// children 캐시 무효화
 		InvalidateChildrenCache();
@@ -422,123 +420,40 @@ namespace Alice {
 	const IPhysicsWorld* World::GetPhysicsWorld() const { return m_physicsWorld.get(); }
 	//========================================================
 
-	// Transform 행렬 계산 헬퍼 (EditorCore와 동일한 로직)
-	namespace
-	{
-		inline DirectX::XMMATRIX BuildRotYPR_Rad(const DirectX::XMFLOAT3& rotation)
-		{
-			return DirectX::XMMatrixRotationRollPitchYaw(rotation.x, rotation.y, rotation.z);
-		}
-
-		inline DirectX::XMMATRIX BuildLocalMatrix(const TransformComponent& transform)
-		{
-			DirectX::XMMATRIX S = DirectX::XMMatrixScaling(transform.scale.x, transform.scale.y, transform.scale.z);
-			DirectX::XMMATRIX R = BuildRotYPR_Rad(transform.rotation);
-			DirectX::XMMATRIX T = DirectX::XMMatrixTranslation(transform.position.x, transform.position.y, transform.position.z);
-			return S * R * T;
-		}
-
-		// 내부 헬퍼 함수 (SetParent 등에서 사용)
-		inline DirectX::XMMATRIX ComputeWorldMatrix_Internal(const World& world, EntityId entityId)
-		{
-			std::vector<DirectX::XMMATRIX> matrixStack;
-			EntityId currentId = entityId;
-
-			while (currentId != InvalidEntityId)
-			{
-				const TransformComponent* t = world.GetComponent<TransformComponent>(currentId);
-				if (t)
-				{
-					DirectX::XMMATRIX localMatrix = BuildLocalMatrix(*t);
-					matrixStack.push_back(localMatrix);
-					currentId = t->parent;
-				}
-				else
-				{
-					break;
-				}
-			}
-
-			DirectX::XMMATRIX worldMatrix = DirectX::XMMatrixIdentity();
-			for (const auto& m : matrixStack)
-			{
-				worldMatrix = worldMatrix * m;
-			}
-
-			return worldMatrix;
-		}
-	}
-
 	// Transform 행렬 계산 (공용 API)
 	DirectX::XMMATRIX World::ComputeWorldMatrix(EntityId entityId) const
 	{
 		if (entityId == InvalidEntityId)
 			return DirectX::XMMatrixIdentity();
-		
-		// 캐시 확인
-		auto cacheIt = m_worldMatrixCache.find(entityId);
-		if (cacheIt != m_worldMatrixCache.end())
-		{
-			// dirty 플래그 확인
-			auto dirtyIt = m_transformDirty.find(entityId);
-			if (dirtyIt == m_transformDirty.end() || !dirtyIt->second)
-			{
-				// 캐시가 유효하면 반환
-				return DirectX::XMLoadFloat4x4(&cacheIt->second);
-			}
-		}
-		
-		// 캐시 미스 또는 dirty: 재계산
-		DirectX::XMMATRIX worldMatrix = ComputeWorldMatrix_Internal(*this, entityId);
-		
-		// 캐시에 저장 (const 함수이지만 mutable 멤버이므로 가능)
-		DirectX::XMFLOAT4X4 cachedMatrix;
-		DirectX::XMStoreFloat4x4(&cachedMatrix, worldMatrix);
-		m_worldMatrixCache[entityId] = cachedMatrix;		
-		m_transformDirty[entityId] = false; // dirty 플래그 클리어
-		
-		return worldMatrix;
+
+		// 캐시가 유효하면 그대로, dirty면 부모 체인 중 dirty인 슬롯만 재계산 후 캐시
+		return m_transformHierarchy.Resolve(entityId, GetStorageConst<TransformComponent>());
 	}
 	
 	void World::MarkTransformDirty(EntityId entityId)
 	{
 		if (entityId == InvalidEntityId)
 			return;
-		
-		m_transformDirty[entityId] = true;
-		
-		// 자식은 children 캐시 없이 Transform 스토리지 스캔 (SetParent 시 캐시 타이밍 이슈 방지)
-		const auto& transforms = GetComponents<TransformComponent>();
-		for (const auto& [eid, tr] : transforms)
+
+		// tr.parent를 직접 바꾼 경우(예: 소켓 부착 해제) 계층과 동기화
+		if (const auto* t = GetComponent<TransformComponent>(entityId))
 		{
-			if (tr.parent == entityId)
-				MarkTransformDirty(eid);
+			if (t->parent != m_transformHierarchy.GetParent(entityId))
+			{
+				InvalidateChildrenCache();
+				m_transformHierarchy.SetParent(entityId, t->parent);
+			}
 		}
+
+		// 자신과 모든 자손을 dirty로 표시
+		m_transformHierarchy.MarkDirty(entityId);
 	}
 	
 	void World::UpdateTransformMatrices()
 	{
-		// dirty 플래그가 있는 모든 엔티티의 월드행렬을 재계산
-		std::vector<EntityId> dirtyEntities;
-		dirtyEntities.reserve(m_transformDirty.size());
-		
-		for (const auto& [entityId, isDirty] : m_transformDirty)
-		{
-			if (isDirty)
-			{
-				dirtyEntities.push_back(entityId);
-			}
-		}
-		
-		// 각 dirty 엔티티의 월드행렬 재계산
-		for (EntityId entityId : dirtyEntities)
-		{
-			DirectX::XMMATRIX worldMatrix = ComputeWorldMatrix_Internal(*this, entityId);
-			DirectX::XMFLOAT4X4 cachedMatrix;
-			DirectX::XMStoreFloat4x4(&cachedMatrix, worldMatrix);
-			m_worldMatrixCache[entityId] = cachedMatrix;
-			m_transformDirty[entityId] = false;
-		}
+		// 부모가 항상 앞에 오도록 정렬된 계층을 한 번만 순회하며
+		// dirty 엔티티의 월드행렬 = 로컬행렬 * (이미 계산된) 부모 월드행렬
+		m_transformHierarchy.Update(GetStorageConst<TransformComponent>());
 	}
 
 	inline DirectX::XMFLOAT3 QuaternionToYPR_Rad(DirectX::FXMVECTOR q)
@@ -612,11 +527,11 @@ namespace Alice {
 		if (keepWorld)
 		{
 			// 현재 월드 위치 계산
-			childWorld = ComputeWorldMatrix_Internal(*this, child);
+			childWorld = ComputeWorldMatrix(child);
 
 			// 새 부모의 월드 행렬 계산
 			DirectX::XMMATRIX newParentWorld = (parent != InvalidEntityId)
-				? ComputeWorldMatrix_Internal(*this, parent)
+				? ComputeWorldMatrix(parent)
 				: DirectX::XMMatrixIdentity();
 
 			// 역행렬 계산
@@ -627,8 +542,9 @@ namespace Alice {
 		// children 캐시 무효화
 		InvalidateChildrenCache();
 
-		// 새 부모 설정
+		// 새 부모 설정 (계층도 함께 갱신)
 		childTransform->parent = parent;
+		m_transformHierarchy.SetParent(child, parent);
 		
 		// Transform 변경: child와 모든 자식을 dirty로 표시
 		MarkTransformDirty(child);
@@ -14,6 +14,7 @@
 #include "Runtime/Scripting/IScript.h"
 #include "Runtime/Scripting/Components/ScriptComponent.h"
 #include "Runtime/ECS/Components/ComponentStorage.h"
+#include "Runtime/ECS/TransformHierarchy.h"
 
 // 컴포넌트 헤더들
 #include "Runtime/ECS/Components/IDComponent.h"
@@ -168,11 +169,11 @@ namespace Alice
                     result = &storage.Add(id, std::move(newComp));
                 }
                 
-                // TransformComponent 추가/제거 시 children 캐시 무효화 및 Transform dirty 마킹
+                // TransformComponent 추가/제거 시 children 캐시 무효화 및 계층 등록(dirty 마킹 포함)
                 if constexpr (std::is_same_v<T, TransformComponent>)
                 {
                     InvalidateChildrenCache();
-                    MarkTransformDirty(id);
+                    m_transformHierarchy.Insert(id, result->parent);
                 }
                 
                 // PostProcessVolumeComponent 추가 시 DebugDrawBoxComponent도 자동 추가
@@ -334,11 +335,11 @@ namespace Alice
             {
                 auto& storage = GetStorage<T>();
                 
-                // TransformComponent 제거 시 children 캐시 무효화 및 Transform dirty 마킹
+                // TransformComponent 제거 시 children 캐시 무효화 및 계층에서 해제 (남은 자식은 루트로 취급)
                 if constexpr (std::is_same_v<T, TransformComponent>)
                 {
                     InvalidateChildrenCache();
-                    MarkTransformDirty(id);
+                    m_transformHierarchy.Remove(id);
                 }
                 
                 storage.Remove(id);
@@ -419,7 +420,7 @@ namespace Alice
         DirectX::XMMATRIX ComputeWorldMatrix(EntityId entityId) const;
         
         /// Transform 월드행렬 캐시를 갱신합니다. (매 프레임 호출 권장)
-        /// dirty 플래그가 있는 엔티티들의 월드행렬을 재계산합니다.
+        /// 위상 정렬된 계층을 한 번 선형 순회하며 dirty 엔티티의 월드행렬을 부모 결과로부터 재계산합니다.
         void UpdateTransformMatrices();
         
         /// 특정 엔티티와 모든 자식의 Transform을 dirty로 표시합니다.
@@ -552,12 +553,8 @@ namespace Alice
         void InvalidateChildrenCache() const { m_children.clear(); }
         
         // Transform 월드행렬 캐싱 시스템
-        // dirty 플래그: 엔티티의 Transform이 변경되어 월드행렬 재계산이 필요한지 표시
-        mutable std::unordered_map<EntityId, bool> m_transformDirty;
-        
-        // 월드행렬 캐시: EntityId -> 월드행렬 (XMMATRIX는 값 타입이므로 직접 저장)
-        // XMMATRIX는 16개 float이므로 XMFLOAT4X4로 저장
-        mutable std::unordered_map<EntityId, DirectX::XMFLOAT4X4> m_worldMatrixCache;
+        // 부모-자식 순서로 정렬된 계층 + dirty 비트 + 월드행렬 캐시 (ComputeWorldMatrix가 const라 mutable)
+        mutable TransformHierarchy m_transformHierarchy;
 
         // Combat frame hit buffer (owned by engine)
         const std::vector<CombatHitEvent>* m_frameCombatHits = nullptr;